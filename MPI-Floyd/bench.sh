@@ -0,0 +1,120 @@
+#!/bin/sh
+# Strong- and weak-scaling sweeps of floyd on a single machine.
+#
+# Every run writes Floyd.stats (per-phase min/mean/max across ranks); the rows
+# are collected into one CSV prefixed with the sweep mode and repetition.
+# Phases: ingest, ingest_wait, scatter, bcast, compute, gather_wait, gather,
+# output, total. The *_wait phases are time spent waiting for other ranks.
+#
+# Tunables (environment):
+#   PROCS        rank counts to sweep               (default "1 2 4")
+#   STRONG_V     fixed V values for strong scaling  (default 840)
+#   WEAK_V       V at one rank for weak scaling     (default 480)
+#   EDGE_FACTOR  edges per vertex                   (default 64)
+#   REPEATS      runs per configuration             (default 3)
+#   SEED         graph generator seed               (default 1)
+#   MPIEXEC      launcher, with any extra flags     (default: mpiexec, plus
+#                --oversubscribe under Open MPI)
+#   OUTPUT       result CSV                         (default bench_results.csv)
+
+set -e
+
+PROCS=${PROCS:-"1 2 4"}
+STRONG_V=${STRONG_V:-840}
+WEAK_V=${WEAK_V:-480}
+EDGE_FACTOR=${EDGE_FACTOR:-64}
+REPEATS=${REPEATS:-3}
+SEED=${SEED:-1}
+OUTPUT=${OUTPUT:-bench_results.csv}
+
+if [ -z "$MPIEXEC" ]; then
+    MPIEXEC=mpiexec
+    if mpiexec --version 2>/dev/null | grep -qi "open-\?mpi\|openrte"; then
+        MPIEXEC="mpiexec --oversubscribe"
+    fi
+fi
+
+HERE=$(cd "$(dirname "$0")" && pwd)
+WORK_DIR=$(mktemp -d)
+trap 'rm -rf "$WORK_DIR"' EXIT
+
+# Round V down to a multiple of the rank count, since floyd needs V % p == 0
+round_to_procs()
+{
+    echo $(($1 / $2 * $2))
+}
+
+# Round V to the nearest positive multiple of the rank count
+round_nearest_to_procs()
+{
+    v=$((($1 + $2 / 2) / $2 * $2))
+    if [ "$v" -eq 0 ]; then
+        v=$2
+    fi
+    echo "$v"
+}
+
+# Least common multiple of all arguments
+lcm()
+{
+    result=1
+    for n in "$@"; do
+        a=$result
+        b=$n
+        while [ "$b" -ne 0 ]; do
+            t=$((a % b))
+            a=$b
+            b=$t
+        done
+        result=$((result / a * n))
+    done
+    echo "$result"
+}
+
+# run_config MODE PROCS V
+run_config()
+{
+    edges=$(($3 * EDGE_FACTOR))
+    (cd "$WORK_DIR" && "$HERE/graph_generator" -v "$3" -e "$edges" \
+        -s "$SEED" >/dev/null)
+    rep=1
+    while [ "$rep" -le "$REPEATS" ]; do
+        (cd "$WORK_DIR" && $MPIEXEC -n "$2" "$HERE/floyd" >/dev/null)
+        tail -n +2 "$WORK_DIR/Floyd.stats" | sed "s/^/$1,$rep,/" >>"$OUTPUT"
+        rep=$((rep + 1))
+    done
+    echo "$1: procs=$2 V=$3 done"
+}
+
+# Strong scaling keeps V fixed, so it must divide evenly by every rank count
+procs_lcm=$(lcm $PROCS)
+strong_vs=
+for v in $STRONG_V; do
+    strong_v=$(round_to_procs "$v" "$procs_lcm")
+    if [ "$strong_v" -eq 0 ]; then
+        echo "STRONG_V=$v is smaller than lcm($PROCS)" >&2
+        exit 1
+    fi
+    if [ "$strong_v" -ne "$v" ]; then
+        echo "strong: rounding V from $v to $strong_v"
+    fi
+    strong_vs="$strong_vs $strong_v"
+done
+
+printf "mode,rep,phase,procs,V,time_min,time_mean,time_max,%s\n" \
+    "sent_min,sent_mean,sent_max,recv_min,recv_mean,recv_max" >"$OUTPUT"
+for v in $strong_vs; do
+    for p in $PROCS; do
+        run_config strong "$p" "$v"
+    done
+done
+
+# Floyd does O(V^3) work, so V grows with the cube root of the rank count
+# to keep the work per rank constant
+for p in $PROCS; do
+    v=$(awk -v v="$WEAK_V" -v p="$p" \
+        'BEGIN { printf "%d", v * p ^ (1 / 3) + 0.5 }')
+    run_config weak "$p" "$(round_nearest_to_procs "$v" "$p")"
+done
+
+echo "Results written to $OUTPUT"
@@ -5,6 +5,34 @@
 // Defining a very large value as a substitute for infinity
 #define INF 1000000
 
+// Per-rank statistics are reduced to rank 0 and written here as CSV
+#define STATS_FILE "Floyd.stats"
+
+// Phases of a run that are timed separately on every rank
+enum phase {
+    PHASE_INGEST,
+    PHASE_INGEST_WAIT,
+    PHASE_SCATTER,
+    PHASE_BCAST,
+    PHASE_COMPUTE,
+    PHASE_GATHER_WAIT,
+    PHASE_GATHER,
+    PHASE_OUTPUT,
+    PHASE_TOTAL,
+    PHASE_COUNT
+};
+
+static const char *phase_names[PHASE_COUNT] = {
+    "ingest",      "ingest_wait", "scatter", "bcast", "compute",
+    "gather_wait", "gather",      "output",  "total"};
+
+// Wall time and message volume spent by one rank in each phase
+struct phase_stats {
+    double seconds[PHASE_COUNT];
+    long long bytes_sent[PHASE_COUNT];
+    long long bytes_recv[PHASE_COUNT];
+};
+
 // Function to determine the owner of the kth row
 int calculate_owner(int k, int total_procs, int V)
 {
@@ -23,7 +51,7 @@ void fetch_kth_row(int *matrix_data, int V, int total_procs, int *target_row,
 
 // Implementation of the Floyd-Warshall algorithm
 void execute_floyd(int *matrix, int V, int process_id, int total_procs,
-                   MPI_Comm communicator)
+                   struct phase_stats *stats, MPI_Comm communicator)
 {
     int *target_row = (int *) malloc(V * sizeof(int));
     if (!target_row) {
@@ -31,19 +59,26 @@ void execute_floyd(int *matrix, int V, int process_id, int total_procs,
         MPI_Abort(communicator, 1);
     }
 
+    long long row_bytes = (long long) V * sizeof(int);
     for (int k = 0; k < V; k++) {
+        double phase_start = MPI_Wtime();
         int root_process = calculate_owner(k, total_procs, V);
         if (process_id == root_process) {
             fetch_kth_row(matrix, V, total_procs, target_row, k);
             for (int i = 0; i < total_procs; i++) {
                 if (i != process_id) {
                     MPI_Send(target_row, V, MPI_INT, i, 0, communicator);
+                    stats->bytes_sent[PHASE_BCAST] += row_bytes;
                 }
             }
         } else {
             MPI_Recv(target_row, V, MPI_INT, root_process, 0, communicator,
                      MPI_STATUS_IGNORE);
+            stats->bytes_recv[PHASE_BCAST] += row_bytes;
         }
+        double phase_end = MPI_Wtime();
+        stats->seconds[PHASE_BCAST] += phase_end - phase_start;
+        phase_start = phase_end;
 
         for (int i = 0; i < V / total_procs; i++) {
             for (int j = 0; j < V; j++) {
@@ -53,6 +88,7 @@ void execute_floyd(int *matrix, int V, int process_id, int total_procs,
                 }
             }
         }
+        stats->seconds[PHASE_COMPUTE] += MPI_Wtime() - phase_start;
     }
     free(target_row);
 }
@@ -69,9 +105,13 @@ void initialize_matrix(int *matrix, int V)
 
 // Read the matrix from a file and distribute it among processes
 void distribute_matrix_from_file(int *matrix, int V, int total_procs,
-                                 const char *filename, MPI_Comm communicator)
+                                 const char *filename,
+                                 struct phase_stats *stats,
+                                 MPI_Comm communicator)
 {
     int process_id, *buffer = NULL;
+    long long chunk_bytes = (long long) V * V / total_procs * sizeof(int);
+    double phase_start = MPI_Wtime();
     MPI_Comm_rank(communicator, &process_id);
 
     if (process_id == 0) {
@@ -102,20 +142,43 @@ void distribute_matrix_from_file(int *matrix, int V, int total_procs,
 
         fclose(file_ptr);
 
+        double ingest_end = MPI_Wtime();
+        stats->seconds[PHASE_INGEST] += ingest_end - phase_start;
+        phase_start = ingest_end;
+    }
+
+    // Keep the other ranks' wait for rank 0's ingest out of the scatter time
+    MPI_Barrier(communicator);
+    double phase_end = MPI_Wtime();
+    stats->seconds[PHASE_INGEST_WAIT] += phase_end - phase_start;
+    phase_start = phase_end;
+
+    if (process_id == 0) {
         MPI_Scatter(buffer, V * V / total_procs, MPI_INT, matrix,
                     V * V / total_procs, MPI_INT, 0, communicator);
+        stats->bytes_sent[PHASE_SCATTER] += chunk_bytes * (total_procs - 1);
         free(buffer);
     } else {
         MPI_Scatter(buffer, V * V / total_procs, MPI_INT, matrix,
                     V * V / total_procs, MPI_INT, 0, communicator);
+        stats->bytes_recv[PHASE_SCATTER] += chunk_bytes;
     }
+    stats->seconds[PHASE_SCATTER] += MPI_Wtime() - phase_start;
 }
 
 void print_matrix(int *matrix, int V, int process_id, int total_procs,
-                  MPI_Comm communicator)
+                  struct phase_stats *stats, MPI_Comm communicator)
 {
     int *aggregate_matrix = NULL;
     FILE *file = NULL;
+    long long chunk_bytes = (long long) V * V / total_procs * sizeof(int);
+    double phase_start = MPI_Wtime();
+
+    // Keep the wait for the slowest rank's last iterations out of the gather
+    MPI_Barrier(communicator);
+    double phase_end = MPI_Wtime();
+    stats->seconds[PHASE_GATHER_WAIT] += phase_end - phase_start;
+    phase_start = phase_end;
 
     if (process_id == 0) {
         aggregate_matrix = (int *) malloc(V * V * sizeof(int));
@@ -126,6 +189,11 @@ void print_matrix(int *matrix, int V, int process_id, int total_procs,
 
         MPI_Gather(matrix, V * V / total_procs, MPI_INT, aggregate_matrix,
                    V * V / total_procs, MPI_INT, 0, communicator);
+        stats->bytes_recv[PHASE_GATHER] += chunk_bytes * (total_procs - 1);
+
+        double gather_end = MPI_Wtime();
+        stats->seconds[PHASE_GATHER] += gather_end - phase_start;
+        phase_start = gather_end;
 
         file = fopen("Floyd.output", "w");
         if (!file) {
@@ -144,10 +212,69 @@ void print_matrix(int *matrix, int V, int process_id, int total_procs,
         }
         free(aggregate_matrix);
         fclose(file);
+        stats->seconds[PHASE_OUTPUT] += MPI_Wtime() - phase_start;
     } else {
         MPI_Gather(matrix, V * V / total_procs, MPI_INT, NULL,
                    V * V / total_procs, MPI_INT, 0, communicator);
+        stats->bytes_sent[PHASE_GATHER] += chunk_bytes;
+        stats->seconds[PHASE_GATHER] += MPI_Wtime() - phase_start;
+    }
+}
+
+// Reduce per-rank phase statistics to min/mean/max and write them as CSV
+void report_stats(struct phase_stats *stats, int V, int process_id,
+                  int total_procs, MPI_Comm communicator)
+{
+    struct phase_stats min, max, sum;
+
+    // Total time is measured as one span by the caller; only bytes add up
+    stats->bytes_sent[PHASE_TOTAL] = 0;
+    stats->bytes_recv[PHASE_TOTAL] = 0;
+    for (int p = 0; p < PHASE_TOTAL; p++) {
+        stats->bytes_sent[PHASE_TOTAL] += stats->bytes_sent[p];
+        stats->bytes_recv[PHASE_TOTAL] += stats->bytes_recv[p];
     }
+
+    MPI_Reduce(stats->seconds, min.seconds, PHASE_COUNT, MPI_DOUBLE, MPI_MIN,
+               0, communicator);
+    MPI_Reduce(stats->seconds, max.seconds, PHASE_COUNT, MPI_DOUBLE, MPI_MAX,
+               0, communicator);
+    MPI_Reduce(stats->seconds, sum.seconds, PHASE_COUNT, MPI_DOUBLE, MPI_SUM,
+               0, communicator);
+    MPI_Reduce(stats->bytes_sent, min.bytes_sent, PHASE_COUNT, MPI_LONG_LONG,
+               MPI_MIN, 0, communicator);
+    MPI_Reduce(stats->bytes_sent, max.bytes_sent, PHASE_COUNT, MPI_LONG_LONG,
+               MPI_MAX, 0, communicator);
+    MPI_Reduce(stats->bytes_sent, sum.bytes_sent, PHASE_COUNT, MPI_LONG_LONG,
+               MPI_SUM, 0, communicator);
+    MPI_Reduce(stats->bytes_recv, min.bytes_recv, PHASE_COUNT, MPI_LONG_LONG,
+               MPI_MIN, 0, communicator);
+    MPI_Reduce(stats->bytes_recv, max.bytes_recv, PHASE_COUNT, MPI_LONG_LONG,
+               MPI_MAX, 0, communicator);
+    MPI_Reduce(stats->bytes_recv, sum.bytes_recv, PHASE_COUNT, MPI_LONG_LONG,
+               MPI_SUM, 0, communicator);
+
+    if (process_id != 0) {
+        return;
+    }
+
+    FILE *file = fopen(STATS_FILE, "w");
+    if (!file) {
+        fprintf(stderr, "Failed to open file %s\n", STATS_FILE);
+        MPI_Abort(communicator, 1);
+    }
+
+    fprintf(file, "phase,procs,V,time_min,time_mean,time_max,"
+                  "sent_min,sent_mean,sent_max,recv_min,recv_mean,recv_max\n");
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        fprintf(file, "%s,%d,%d,%.6f,%.6f,%.6f,%lld,%.0f,%lld,%lld,%.0f,%lld\n",
+                phase_names[p], total_procs, V, min.seconds[p],
+                sum.seconds[p] / total_procs, max.seconds[p],
+                min.bytes_sent[p], (double) sum.bytes_sent[p] / total_procs,
+                max.bytes_sent[p], min.bytes_recv[p],
+                (double) sum.bytes_recv[p] / total_procs, max.bytes_recv[p]);
+    }
+    fclose(file);
 }
 
 int main(int argc, char *argv[])
@@ -155,13 +282,16 @@ int main(int argc, char *argv[])
     int V, *distributed_matrix;
     MPI_Comm comm = MPI_COMM_WORLD;
     int total_procs, process_id;
-    double start_time, end_time;
+    double run_start, start_time, end_time;
+    struct phase_stats stats = {0};
 
     MPI_Init(&argc, &argv);
     MPI_Comm_size(comm, &total_procs);
     MPI_Comm_rank(comm, &process_id);
+    run_start = MPI_Wtime();
 
     if (process_id == 0) {
+        start_time = MPI_Wtime();
         FILE *input_file = fopen("Floyd.input", "r");
         if (!input_file) {
             fprintf(stderr, "Failed to open the input file.\n");
@@ -179,9 +309,19 @@ int main(int argc, char *argv[])
                 V, total_procs);
             MPI_Abort(comm, 1);
         }
+        stats.seconds[PHASE_INGEST] += MPI_Wtime() - start_time;
     }
 
+    // Non-root ranks wait here while rank 0 reads the header
+    start_time = MPI_Wtime();
     MPI_Bcast(&V, 1, MPI_INT, 0, comm);
+    stats.seconds[PHASE_INGEST_WAIT] += MPI_Wtime() - start_time;
+    if (process_id == 0) {
+        stats.bytes_sent[PHASE_SCATTER] +=
+            (long long) sizeof(int) * (total_procs - 1);
+    } else {
+        stats.bytes_recv[PHASE_SCATTER] += sizeof(int);
+    }
 
     distributed_matrix = (int *) malloc(V * V / total_procs * sizeof(int));
     if (!distributed_matrix) {
@@ -191,20 +331,24 @@ int main(int argc, char *argv[])
     }
 
     distribute_matrix_from_file(distributed_matrix, V, total_procs,
-                                "Floyd.input", comm);
+                                "Floyd.input", &stats, comm);
 
     if (process_id == 0) {
         start_time = MPI_Wtime();
     }
 
-    execute_floyd(distributed_matrix, V, process_id, total_procs, comm);
+    execute_floyd(distributed_matrix, V, process_id, total_procs, &stats,
+                  comm);
 
     if (process_id == 0) {
         end_time = MPI_Wtime();
         printf("Time taken: %f seconds\n", end_time - start_time);
     }
 
-    print_matrix(distributed_matrix, V, process_id, total_procs, comm);
+    print_matrix(distributed_matrix, V, process_id, total_procs, &stats,
+                 comm);
+    stats.seconds[PHASE_TOTAL] = MPI_Wtime() - run_start;
+    report_stats(&stats, V, process_id, total_procs, comm);
 
     free(distributed_matrix);
     MPI_Finalize();
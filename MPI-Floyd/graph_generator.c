@@ -0,0 +1,129 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// Output buffer size, large enough to keep stdio calls off the hot path
+#define BUFFER_SIZE (1 << 20)
+
+static uint64_t rng_state;
+
+// splitmix64: fast, good enough for random test graphs
+uint64_t next_random(void)
+{
+    uint64_t z = (rng_state += 0x9e3779b97f4a7c15ULL);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+}
+
+// Uniform integer in [low, high]
+long long random_between(long long low, long long high)
+{
+    return low + (long long) (next_random() % (uint64_t) (high - low + 1));
+}
+
+// Append the decimal form of value followed by terminator to out
+char *write_number(char *out, long long value, char terminator)
+{
+    char digits[24];
+    int length = 0;
+    do {
+        digits[length++] = (char) ('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    while (length > 0) {
+        *out++ = digits[--length];
+    }
+    *out++ = terminator;
+    return out;
+}
+
+void usage(const char *program)
+{
+    fprintf(stderr,
+            "Usage: %s -v vertices [-e edges] [-s seed] [-o file]\n"
+            "Writes a random undirected graph in the format read by floyd.\n"
+            "Edges default to V * (V - 1) / 4. Duplicate vertex pairs are\n"
+            "possible; floyd keeps the lightest one.\n",
+            program);
+}
+
+int main(int argc, char *argv[])
+{
+    long long V = 0, E = -1;
+    uint64_t seed = (uint64_t) time(NULL);
+    const char *filename = "Floyd.input";
+    int opt;
+
+    while ((opt = getopt(argc, argv, "v:e:s:o:h")) != -1) {
+        switch (opt) {
+        case 'v':
+            V = atoll(optarg);
+            break;
+        case 'e':
+            E = atoll(optarg);
+            break;
+        case 's':
+            seed = strtoull(optarg, NULL, 10);
+            break;
+        case 'o':
+            filename = optarg;
+            break;
+        default:
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (V < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    if (E < 0) {
+        E = V * (V - 1) / 4;
+    }
+    rng_state = seed;
+
+    FILE *file = fopen(filename, "w");
+    if (!file) {
+        fprintf(stderr, "Failed to open file %s\n", filename);
+        return 1;
+    }
+
+    char *buffer = (char *) malloc(BUFFER_SIZE);
+    if (!buffer) {
+        fprintf(stderr, "Failed to allocate memory for buffer\n");
+        fclose(file);
+        return 1;
+    }
+
+    // One edge line is at most three 20-digit numbers plus separators
+    char *end = buffer + BUFFER_SIZE - 64;
+    char *out = write_number(buffer, V, '\n');
+    for (long long i = 0; i < E; i++) {
+        long long a = random_between(1, V - 1);
+        long long b = random_between(a + 1, V);
+        long long weight = random_between(1, 100);
+        out = write_number(out, a, ' ');
+        out = write_number(out, b, ' ');
+        out = write_number(out, weight, '\n');
+        if (out >= end) {
+            fwrite(buffer, 1, out - buffer, file);
+            out = buffer;
+        }
+    }
+    fwrite(buffer, 1, out - buffer, file);
+
+    free(buffer);
+    if (fclose(file) != 0) {
+        fprintf(stderr, "Failed to write file %s\n", filename);
+        return 1;
+    }
+
+    printf("Generated graph with %lld vertices and %lld edges in '%s'.\n", V,
+           E, filename);
+    return 0;
+}